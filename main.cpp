@@ -75,14 +75,22 @@ extern "C" {
 #include <string>
 #include <cctype>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 #include "./resources/zain_black.h"
 #include "./resources/zain_regular.h"
 
 using namespace std;
 
+// glfw is linked into raylib, used to wake the ui loop from the capture thread
+extern "C" void glfwPostEmptyEvent(void);
+
 // forward declarations
 class ScreenCapture;
+class CaptureWorker;
 struct WindowsScreenCapture;
 
 // function declarations
@@ -98,9 +106,38 @@ public:
     ScreenCapture();
     ~ScreenCapture();
     bool Initialize();
+    bool IsClientAlive();
     cv::Mat CaptureScreen();
 };
 
+// grabs frames off the ui thread and wakes the ui only when there is something new to draw
+class CaptureWorker {
+private:
+    ScreenCapture screenCap;
+    thread worker;
+    mutex stateMutex;
+    condition_variable wakeCondition;
+    cv::Mat latestFrame;
+    bool frameReady;
+    bool clientDetected;
+    bool minimized;
+    bool timerRunning;
+    double timerStart;
+    bool wakeRequested;
+    bool stopping;
+    double frameInterval;
+    double clientRefreshInterval;
+    void Run();
+public:
+    CaptureWorker(int maxFps, double clientRefreshInterval);
+    ~CaptureWorker();
+    void Start();
+    void Stop();
+    bool TakeFrame(cv::Mat& frame);
+    void SetMinimized(bool minimized);
+    void SetTimer(bool running, double start);
+};
+
 // main
 int main() {
     const int NATIVE_WIDTH = 2400;
@@ -108,7 +145,7 @@ int main() {
     const int WINDOW_WIDTH = 600;
     const int WINDOW_HEIGHT = 300;
     const int MAX_FPS = 60;
-    const int CLIENT_REFRESH_FRAME_WAIT = 300;
+    const double CLIENT_REFRESH_INTERVAL = 5.0;
     const string BACKGROUND_HEX = "#1B1E24";
     const string PRIMARY_HEX = "#272A33";
     const int HANDLE_SIZE = 20;
@@ -128,16 +165,14 @@ int main() {
     static float stopTime = 0.0f;
 
 
-    // initialize screen capture
-    ScreenCapture screenCap;
-    if (!screenCap.Initialize()) {
-        // continue instead of quitting
-    }
+    // screen capture runs on its own thread, continues even if roblox is not open yet
+    CaptureWorker captureWorker(MAX_FPS, CLIENT_REFRESH_INTERVAL);
 
-    SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE | FLAG_WINDOW_UNDECORATED);
+    SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE | FLAG_WINDOW_UNDECORATED | FLAG_WINDOW_ALWAYS_RUN);
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "autoFish");
     SetTraceLogLevel(LOG_NONE);
     SetTargetFPS(MAX_FPS);
+    EnableEventWaiting(); // sleep until input or a wake from the capture thread
 
     // load embedded fonts
     Font zainBlack = LoadFontFromMemory(".ttf", zain_black_data, zain_black_data_size, 100, nullptr, 0);
@@ -166,7 +201,12 @@ int main() {
     bool draggingLeftSlider = false;
     bool draggingRightSlider = false;
 
-    int frameCount = 0;
+    bool needsRedraw = true;
+    int drawnTimerSeconds = -1;
+    int renderCount = 0;
+    int blitCount = 0;
+
+    captureWorker.Start();
 
     while (!WindowShouldClose()) {
         float structureScale = windowSize.x / (float)NATIVE_WIDTH;
@@ -179,6 +219,7 @@ int main() {
         };  
              
         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            needsRedraw = true;
             float scale = windowSize.x / (float)WINDOW_WIDTH;
             Rectangle handle = {windowSize.x - (float)HANDLE_SIZE, windowSize.y - (float)HANDLE_SIZE, (float)HANDLE_SIZE, (float)HANDLE_SIZE};
             Rectangle topBar = {0, 0, windowSize.x, TOP_BAR_HEIGHT * scale};
@@ -234,6 +275,7 @@ int main() {
                         timerRunning = false;
                         stopTime = GetTime();
                     }
+                    captureWorker.SetTimer(timerRunning, startTime);
                     wasTogglePressed = TOGGLE_PRESSED;
                 }
             }
@@ -244,6 +286,7 @@ int main() {
             draggingWindow = false;
             draggingLeftSlider = false;
             draggingRightSlider = false;
+            needsRedraw = true;
         }
         
         // handle slider dragging
@@ -253,6 +296,7 @@ int main() {
             
             float progress = Clamp((mousePositionInWindow.x - leftTrackStart) / movableTrackLength, 0.0f, 1.0f);
             videoOffsetY = (progress * 2.0f) - 1.0f;
+            needsRedraw = true;
         }
         
         if (draggingRightSlider && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
@@ -261,6 +305,7 @@ int main() {
 
             float progress = Clamp((mousePositionInWindow.x - rightTrackStart) / movableTrackLength, 0.0f, 1.0f);
             videoScale = SLIDER_MIN_SCALE + (progress * (SLIDER_MAX_SCALE - SLIDER_MIN_SCALE));
+            needsRedraw = true;
         }
         
         if (draggingResize && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
@@ -271,178 +316,198 @@ int main() {
             UnloadRenderTexture(windowTexture);
             windowTexture = LoadRenderTexture((int)windowSize.x, (int)windowSize.y);
             SetTextureFilter(windowTexture.texture, TEXTURE_FILTER_BILINEAR);
+            needsRedraw = true;
         }
         
         if (draggingWindow && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
             SetWindowPosition((int)(absoluteMousePosition.x - dragOffsetToWindow.x), (int)(absoluteMousePosition.y - dragOffsetToWindow.y));
         }
 
-        // capture screen
-        cv::Mat screenMat = screenCap.CaptureScreen();
-        if (!screenMat.empty()) {
-            Image screenImg = MatToRaylibImage(screenMat);
-            if (screenImg.data) {
-                if (textureLoaded) {
-                    UnloadTexture(screenTexture);
+        // always run keeps the loop going while minimized so the worker hears about it,
+        // event waiting still keeps it asleep between events
+        bool windowMinimized = IsWindowMinimized();
+        captureWorker.SetMinimized(windowMinimized);
+
+        // pick up new frame from capture thread, empty frame means the client was lost
+        cv::Mat screenMat;
+        if (captureWorker.TakeFrame(screenMat)) {
+            if (!screenMat.empty()) {
+                Image screenImg = MatToRaylibImage(screenMat);
+                if (screenImg.data) {
+                    if (textureLoaded) {
+                        UnloadTexture(screenTexture);
+                    }
+                    screenTexture = LoadTextureFromImage(screenImg);
+                    textureLoaded = true;
+                    UnloadImage(screenImg);
                 }
-                screenTexture = LoadTextureFromImage(screenImg);
-                textureLoaded = true;
-                UnloadImage(screenImg);
+            } else if (textureLoaded) {
+                UnloadTexture(screenTexture);
+                textureLoaded = false;
             }
-        } else {
-            textureLoaded = false;
+            needsRedraw = true;
+        }
+
+        // counter only changes once a second
+        float currentTime = 0.0f;
+        if (timerRunning) {
+            currentTime = GetTime() - startTime;
+        } else if (stopTime > 0) {
+            currentTime = stopTime - startTime;
+        }
+
+        int totalSeconds = (int)currentTime;
+        if (totalSeconds != drawnTimerSeconds) {
+            drawnTimerSeconds = totalSeconds;
+            needsRedraw = true;
         }
 
         float scale = windowSize.x / (float)WINDOW_WIDTH;
         structureScale = windowSize.x / (float)NATIVE_WIDTH;
 
-        BeginTextureMode(windowTexture);
-            ClearBackground(BLACK);
+        // only re-render the ui when something changed, otherwise reuse last texture
+        if (needsRedraw && !windowMinimized) {
+            BeginTextureMode(windowTexture);
+                ClearBackground(BLACK);
             
-            // draw background
-            DrawRectanglePro((Rectangle){0, 0, windowSize.x, windowSize.y}, (Vector2){0, 0}, 0.0f, HexToColor(BACKGROUND_HEX));
+                // draw background
+                DrawRectanglePro((Rectangle){0, 0, windowSize.x, windowSize.y}, (Vector2){0, 0}, 0.0f, HexToColor(BACKGROUND_HEX));
             
-            // draw top bar
-            DrawRectanglePro((Rectangle){0, 0, windowSize.x, 96 * structureScale}, (Vector2){0, 0}, 0.0f, HexToColor(PRIMARY_HEX));
-            DrawCircleSector((Vector2){864 * structureScale, 96 * structureScale}, 40 * structureScale, 45, 180, 32, HexToColor(PRIMARY_HEX));
-            DrawCircleSector((Vector2){1536 * structureScale, 96 * structureScale}, 40 * structureScale, 0, 135, 32, HexToColor(PRIMARY_HEX));
-            DrawCircleSector((Vector2){832 * structureScale, 176 * structureScale}, 80 * structureScale, 180, 360, 32, HexToColor(BACKGROUND_HEX));
-            DrawCircleSector((Vector2){1568 * structureScale, 176 * structureScale}, 80 * structureScale, 180, 360, 32, HexToColor(BACKGROUND_HEX));
+                // draw top bar
+                DrawRectanglePro((Rectangle){0, 0, windowSize.x, 96 * structureScale}, (Vector2){0, 0}, 0.0f, HexToColor(PRIMARY_HEX));
+                DrawCircleSector((Vector2){864 * structureScale, 96 * structureScale}, 40 * structureScale, 45, 180, 32, HexToColor(PRIMARY_HEX));
+                DrawCircleSector((Vector2){1536 * structureScale, 96 * structureScale}, 40 * structureScale, 0, 135, 32, HexToColor(PRIMARY_HEX));
+                DrawCircleSector((Vector2){832 * structureScale, 176 * structureScale}, 80 * structureScale, 180, 360, 32, HexToColor(BACKGROUND_HEX));
+                DrawCircleSector((Vector2){1568 * structureScale, 176 * structureScale}, 80 * structureScale, 180, 360, 32, HexToColor(BACKGROUND_HEX));
             
-            // draw captured video or error message
-            float videoX = 0;
-            float videoY = 114.0f * structureScale;
-            float videoWidth = NATIVE_WIDTH * structureScale;
-            float videoHeight = 600.0f * structureScale;
+                // draw captured video or error message
+                float videoX = 0;
+                float videoY = 114.0f * structureScale;
+                float videoWidth = NATIVE_WIDTH * structureScale;
+                float videoHeight = 600.0f * structureScale;
             
-            BeginScissorMode((int)videoX, (int)videoY, (int)videoWidth, (int)videoHeight);  
-            if (textureLoaded) {                
-                float baseScaleX = videoWidth / screenTexture.width;
-                float baseScaleY = videoHeight / screenTexture.height;
-                float baseMinScale = fmaxf(baseScaleX, baseScaleY);
-                float minEffectiveScale = baseMinScale;
-                float maxEffectiveScale = SLIDER_MAX_SCALE * structureScale;
-                float sliderProgress = (videoScale - SLIDER_MIN_SCALE) / (SLIDER_MAX_SCALE - SLIDER_MIN_SCALE);
-                float actualScale = minEffectiveScale + sliderProgress * (maxEffectiveScale - minEffectiveScale);
+                BeginScissorMode((int)videoX, (int)videoY, (int)videoWidth, (int)videoHeight);  
+                if (textureLoaded) {                
+                    float baseScaleX = videoWidth / screenTexture.width;
+                    float baseScaleY = videoHeight / screenTexture.height;
+                    float baseMinScale = fmaxf(baseScaleX, baseScaleY);
+                    float minEffectiveScale = baseMinScale;
+                    float maxEffectiveScale = SLIDER_MAX_SCALE * structureScale;
+                    float sliderProgress = (videoScale - SLIDER_MIN_SCALE) / (SLIDER_MAX_SCALE - SLIDER_MIN_SCALE);
+                    float actualScale = minEffectiveScale + sliderProgress * (maxEffectiveScale - minEffectiveScale);
                 
-                float scaledWidth = screenTexture.width * actualScale;
-                float scaledHeight = screenTexture.height * actualScale;
-                float centerX = videoX + (videoWidth - scaledWidth) * 0.5f;                
-                float maxOffsetY = (scaledHeight - videoHeight) * 0.5f;                
-                float clampedOffsetY = Clamp(videoOffsetY, -1.0f, 1.0f);
-
-                if (maxOffsetY <= 0) {
-                    clampedOffsetY = 0;
-                }
-                
-                float actualOffsetY = clampedOffsetY * maxOffsetY;
-                float centerY = videoY + (videoHeight - scaledHeight) * 0.5f - actualOffsetY;
+                    float scaledWidth = screenTexture.width * actualScale;
+                    float scaledHeight = screenTexture.height * actualScale;
+                    float centerX = videoX + (videoWidth - scaledWidth) * 0.5f;                
+                    float maxOffsetY = (scaledHeight - videoHeight) * 0.5f;                
+                    float clampedOffsetY = Clamp(videoOffsetY, -1.0f, 1.0f);
+
+                    if (maxOffsetY <= 0) {
+                        clampedOffsetY = 0;
+                    }
                 
-                Rectangle videoSrc = {0.0f, 0.0f, (float)screenTexture.width, (float)screenTexture.height};
-                Rectangle videoDst = {centerX, centerY, scaledWidth, scaledHeight};
-                DrawTexturePro(screenTexture, videoSrc, videoDst, (Vector2){0, 0}, 0.0f, WHITE);
-                DrawRectangleGradientV(0, 112 * structureScale, windowSize.x, 100 * structureScale, HexToColor(BACKGROUND_HEX), HexToColor("#1B1E2400"));
-            } else {            
-                const char* errorText = "roblox player not detected";
-                float fontSize = 200 * structureScale;
-                Vector2 textSize = MeasureTextEx(zainBlack, errorText, fontSize, 1.0f);
-                float textX = videoX + (videoWidth - textSize.x) * 0.5f;
-                float textY = videoY + (videoHeight - textSize.y) * 0.5f;
-                DrawTextEx(zainBlack, errorText, (Vector2){textX, textY}, fontSize, 1.0f, HexToColor("#111417"));
+                    float actualOffsetY = clampedOffsetY * maxOffsetY;
+                    float centerY = videoY + (videoHeight - scaledHeight) * 0.5f - actualOffsetY;
                 
-                if (frameCount >= CLIENT_REFRESH_FRAME_WAIT) {
-                    screenCap.Initialize();
-                    frameCount = 0;
+                    Rectangle videoSrc = {0.0f, 0.0f, (float)screenTexture.width, (float)screenTexture.height};
+                    Rectangle videoDst = {centerX, centerY, scaledWidth, scaledHeight};
+                    DrawTexturePro(screenTexture, videoSrc, videoDst, (Vector2){0, 0}, 0.0f, WHITE);
+                    DrawRectangleGradientV(0, 112 * structureScale, windowSize.x, 100 * structureScale, HexToColor(BACKGROUND_HEX), HexToColor("#1B1E2400"));
+                } else {            
+                    const char* errorText = "roblox player not detected";
+                    float fontSize = 200 * structureScale;
+                    Vector2 textSize = MeasureTextEx(zainBlack, errorText, fontSize, 1.0f);
+                    float textX = videoX + (videoWidth - textSize.x) * 0.5f;
+                    float textY = videoY + (videoHeight - textSize.y) * 0.5f;
+                    DrawTextEx(zainBlack, errorText, (Vector2){textX, textY}, fontSize, 1.0f, HexToColor("#111417"));
                 }
-                frameCount++;
-            }
-            EndScissorMode();
+                EndScissorMode();
             
-            // draw ui overlays
+                // draw ui overlays
             
-            DrawRectanglePro((Rectangle){960 * structureScale, 96 * structureScale, 480 * structureScale, 80 * structureScale}, (Vector2){0, 0}, 0.0f, HexToColor(PRIMARY_HEX));
-            DrawRectanglePro((Rectangle){0, 714 * structureScale, windowSize.x, 10 * structureScale}, (Vector2){0, 0}, 0.0f, HexToColor(PRIMARY_HEX));
-            DrawRectanglePro((Rectangle){960 * structureScale, 136 * structureScale, 96 * structureScale, 80 * structureScale}, (Vector2){96 * structureScale, 40 * structureScale}, 45, HexToColor(PRIMARY_HEX));
-            DrawRectanglePro((Rectangle){1440 * structureScale, 136 * structureScale, 96 * structureScale, 80 * structureScale}, (Vector2){96 * structureScale, 40 * structureScale}, 135, HexToColor(PRIMARY_HEX));
-            DrawCircleSector((Vector2){1440 * structureScale, 136 * structureScale}, 40 * structureScale, 45, 90, 32, HexToColor(PRIMARY_HEX));
-            DrawCircleSector((Vector2){960 * structureScale, 136 * structureScale}, 40 * structureScale, 90, 135, 32, HexToColor(PRIMARY_HEX));
-            DrawTextEx(zainBlack, "autoFish", (Vector2){40 * structureScale, 0}, 100 * structureScale, 1.0f, WHITE);
+                DrawRectanglePro((Rectangle){960 * structureScale, 96 * structureScale, 480 * structureScale, 80 * structureScale}, (Vector2){0, 0}, 0.0f, HexToColor(PRIMARY_HEX));
+                DrawRectanglePro((Rectangle){0, 714 * structureScale, windowSize.x, 10 * structureScale}, (Vector2){0, 0}, 0.0f, HexToColor(PRIMARY_HEX));
+                DrawRectanglePro((Rectangle){960 * structureScale, 136 * structureScale, 96 * structureScale, 80 * structureScale}, (Vector2){96 * structureScale, 40 * structureScale}, 45, HexToColor(PRIMARY_HEX));
+                DrawRectanglePro((Rectangle){1440 * structureScale, 136 * structureScale, 96 * structureScale, 80 * structureScale}, (Vector2){96 * structureScale, 40 * structureScale}, 135, HexToColor(PRIMARY_HEX));
+                DrawCircleSector((Vector2){1440 * structureScale, 136 * structureScale}, 40 * structureScale, 45, 90, 32, HexToColor(PRIMARY_HEX));
+                DrawCircleSector((Vector2){960 * structureScale, 136 * structureScale}, 40 * structureScale, 90, 135, 32, HexToColor(PRIMARY_HEX));
+                DrawTextEx(zainBlack, "autoFish", (Vector2){40 * structureScale, 0}, 100 * structureScale, 1.0f, WHITE);
            
-            // draw resize handle
-            DrawRectangle((int)(windowSize.x - HANDLE_SIZE), (int)(windowSize.y - HANDLE_SIZE), HANDLE_SIZE, HANDLE_SIZE, HexToColor("#14171B"));
+                // draw resize handle
+                DrawRectangle((int)(windowSize.x - HANDLE_SIZE), (int)(windowSize.y - HANDLE_SIZE), HANDLE_SIZE, HANDLE_SIZE, HexToColor("#14171B"));
             
-            // left slider track
-            float leftTrackStart = 40 * structureScale;
-            DrawRectanglePro((Rectangle){leftTrackStart, 950 * structureScale, SLIDER_TRACK_LENGTH * structureScale, 12 * structureScale}, (Vector2){0, 6 * structureScale}, 0.0f, HexToColor("#111417"));
-            DrawTextEx(zainBlack, "move", (Vector2){leftTrackStart, 820 * structureScale}, 100 * structureScale, 1.0f, HexToColor("#C6D2E0"));
-            DrawTextEx(zainBlack, "up", (Vector2){leftTrackStart, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
-            DrawTextEx(zainBlack, "down", (Vector2){leftTrackStart + SLIDER_TRACK_LENGTH * structureScale - MeasureTextEx(zainBlack, "down", 80 * structureScale, 1.0f).x, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
-
-            // left slider handle
-            float movableLeftTrackLength = SLIDER_TRACK_LENGTH * structureScale - SLIDER_HANDLE_WIDTH * structureScale;
-            float leftSliderProgress = (videoOffsetY + 1.0f) * 0.5f;
-            float leftSliderX = leftTrackStart + leftSliderProgress * movableLeftTrackLength;
-            float leftSliderY = 950 * structureScale;
-            DrawRectanglePro((Rectangle){leftSliderX, leftSliderY, SLIDER_HANDLE_WIDTH * structureScale, 40 * structureScale}, (Vector2){0, 20 * structureScale}, 0.0f, HexToColor("#DFE8F5"));
+                // left slider track
+                float leftTrackStart = 40 * structureScale;
+                DrawRectanglePro((Rectangle){leftTrackStart, 950 * structureScale, SLIDER_TRACK_LENGTH * structureScale, 12 * structureScale}, (Vector2){0, 6 * structureScale}, 0.0f, HexToColor("#111417"));
+                DrawTextEx(zainBlack, "move", (Vector2){leftTrackStart, 820 * structureScale}, 100 * structureScale, 1.0f, HexToColor("#C6D2E0"));
+                DrawTextEx(zainBlack, "up", (Vector2){leftTrackStart, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
+                DrawTextEx(zainBlack, "down", (Vector2){leftTrackStart + SLIDER_TRACK_LENGTH * structureScale - MeasureTextEx(zainBlack, "down", 80 * structureScale, 1.0f).x, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
+
+                // left slider handle
+                float movableLeftTrackLength = SLIDER_TRACK_LENGTH * structureScale - SLIDER_HANDLE_WIDTH * structureScale;
+                float leftSliderProgress = (videoOffsetY + 1.0f) * 0.5f;
+                float leftSliderX = leftTrackStart + leftSliderProgress * movableLeftTrackLength;
+                float leftSliderY = 950 * structureScale;
+                DrawRectanglePro((Rectangle){leftSliderX, leftSliderY, SLIDER_HANDLE_WIDTH * structureScale, 40 * structureScale}, (Vector2){0, 20 * structureScale}, 0.0f, HexToColor("#DFE8F5"));
             
-            // right slider track
-            float rightTrackStart = 1560 * structureScale;
-            DrawRectanglePro((Rectangle){rightTrackStart, 950 * structureScale, SLIDER_TRACK_LENGTH * structureScale, 12 * structureScale}, (Vector2){0, 6 * structureScale}, 0.0f, HexToColor("#111417"));
-            DrawTextEx(zainBlack, "zoom", (Vector2){rightTrackStart + SLIDER_TRACK_LENGTH * structureScale - MeasureTextEx(zainBlack, "zoom", 100 * structureScale, 1.0f).x, 820 * structureScale}, 100 * structureScale, 1.0f, HexToColor("#C6D2E0"));
-            DrawTextEx(zainBlack, "out", (Vector2){rightTrackStart, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
-            DrawTextEx(zainBlack, "in", (Vector2){rightTrackStart + SLIDER_TRACK_LENGTH * structureScale - MeasureTextEx(zainBlack, "in", 80 * structureScale, 1.0f).x, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
-
-            // right slider handle
-            float movableRightTrackLength = SLIDER_TRACK_LENGTH * structureScale - SLIDER_HANDLE_WIDTH * structureScale;
-            float rightSliderProgress = (videoScale - SLIDER_MIN_SCALE) / (SLIDER_MAX_SCALE - SLIDER_MIN_SCALE);
-            rightSliderProgress = Clamp(rightSliderProgress, 0.0f, 1.0f);
-            float rightSliderX = rightTrackStart + rightSliderProgress * movableRightTrackLength;
-            float rightSliderY = 950 * structureScale;
-            DrawRectanglePro((Rectangle){rightSliderX, rightSliderY, SLIDER_HANDLE_WIDTH * structureScale, 40 * structureScale}, (Vector2){0, 20 * structureScale}, 0.0f, HexToColor("#DFE8F5"));
+                // right slider track
+                float rightTrackStart = 1560 * structureScale;
+                DrawRectanglePro((Rectangle){rightTrackStart, 950 * structureScale, SLIDER_TRACK_LENGTH * structureScale, 12 * structureScale}, (Vector2){0, 6 * structureScale}, 0.0f, HexToColor("#111417"));
+                DrawTextEx(zainBlack, "zoom", (Vector2){rightTrackStart + SLIDER_TRACK_LENGTH * structureScale - MeasureTextEx(zainBlack, "zoom", 100 * structureScale, 1.0f).x, 820 * structureScale}, 100 * structureScale, 1.0f, HexToColor("#C6D2E0"));
+                DrawTextEx(zainBlack, "out", (Vector2){rightTrackStart, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
+                DrawTextEx(zainBlack, "in", (Vector2){rightTrackStart + SLIDER_TRACK_LENGTH * structureScale - MeasureTextEx(zainBlack, "in", 80 * structureScale, 1.0f).x, 960 * structureScale}, 80 * structureScale, 1.0f, HexToColor("#0A0C0F"));
+
+                // right slider handle
+                float movableRightTrackLength = SLIDER_TRACK_LENGTH * structureScale - SLIDER_HANDLE_WIDTH * structureScale;
+                float rightSliderProgress = (videoScale - SLIDER_MIN_SCALE) / (SLIDER_MAX_SCALE - SLIDER_MIN_SCALE);
+                rightSliderProgress = Clamp(rightSliderProgress, 0.0f, 1.0f);
+                float rightSliderX = rightTrackStart + rightSliderProgress * movableRightTrackLength;
+                float rightSliderY = 950 * structureScale;
+                DrawRectanglePro((Rectangle){rightSliderX, rightSliderY, SLIDER_HANDLE_WIDTH * structureScale, 40 * structureScale}, (Vector2){0, 20 * structureScale}, 0.0f, HexToColor("#DFE8F5"));
             
-            // toggle button
-            DrawCircleSector((Vector2){1200 * structureScale, 950 * structureScale}, 160.0f * structureScale, 0.0f, 360.0f, 100, HexToColor("#3C4151"));
-            DrawRing((Vector2){1200 * structureScale, 950 * structureScale}, 136.0f * structureScale, 142.0f * structureScale, 0.0f, 360.0f, 100, HexToColor("#7380A7"));
-            DrawRing((Vector2){1200 * structureScale, 950 * structureScale}, 100.0f * structureScale, 120.0f * structureScale, 45.0f, 135.0f, 40, HexToColor(TOGGLE_PRESSED ? "#6B8FFA" : "#2C3347"));
-
-            const char* buttonText = TOGGLE_PRESSED ? "STOP" : "START";
-            float fontSize = 100 * structureScale; 
-            Vector2 textSize = MeasureTextEx(zainBlack, buttonText, fontSize, 1.0f);
-            float textX = (1200 * structureScale) - (textSize.x * 0.5f); 
-            float textY = (950 * structureScale) - (textSize.y * 0.5f); 
-            DrawTextEx(zainBlack, buttonText, (Vector2){textX, textY}, fontSize, 1.0f, WHITE);
+                // toggle button
+                DrawCircleSector((Vector2){1200 * structureScale, 950 * structureScale}, 160.0f * structureScale, 0.0f, 360.0f, 100, HexToColor("#3C4151"));
+                DrawRing((Vector2){1200 * structureScale, 950 * structureScale}, 136.0f * structureScale, 142.0f * structureScale, 0.0f, 360.0f, 100, HexToColor("#7380A7"));
+                DrawRing((Vector2){1200 * structureScale, 950 * structureScale}, 100.0f * structureScale, 120.0f * structureScale, 45.0f, 135.0f, 40, HexToColor(TOGGLE_PRESSED ? "#6B8FFA" : "#2C3347"));
+
+                const char* buttonText = TOGGLE_PRESSED ? "STOP" : "START";
+                float fontSize = 100 * structureScale; 
+                Vector2 textSize = MeasureTextEx(zainBlack, buttonText, fontSize, 1.0f);
+                float textX = (1200 * structureScale) - (textSize.x * 0.5f); 
+                float textY = (950 * structureScale) - (textSize.y * 0.5f); 
+                DrawTextEx(zainBlack, buttonText, (Vector2){textX, textY}, fontSize, 1.0f, WHITE);
             
-            // counter text
-            float currentTime = 0.0f;
-            if (timerRunning) {
-                currentTime = GetTime() - startTime;
-            } else if (stopTime > 0) {
-          
-                currentTime = stopTime - startTime;
-            }       
-
-            int totalSeconds = (int)currentTime;
-            int minutes = totalSeconds / 60;
-            int seconds = totalSeconds % 60;
+                // counter text
+                int minutes = totalSeconds / 60;
+                int seconds = totalSeconds % 60;
 
-            const char* timerText = TextFormat("%d:%02d", minutes, seconds);
-            float timerFontSize = 120 * structureScale;
-            Vector2 timerTextSize = MeasureTextEx(zainRegular, timerText, timerFontSize, 1.0f);
-            float timerTextX = (windowSize.x - timerTextSize.x) * 0.5f;
-            float timerTextY = 30 * structureScale;
+                const char* timerText = TextFormat("%d:%02d", minutes, seconds);
+                float timerFontSize = 120 * structureScale;
+                Vector2 timerTextSize = MeasureTextEx(zainRegular, timerText, timerFontSize, 1.0f);
+                float timerTextX = (windowSize.x - timerTextSize.x) * 0.5f;
+                float timerTextY = 30 * structureScale;
 
-            DrawTextEx(zainBlack, timerText, (Vector2){timerTextX, timerTextY}, timerFontSize, 1.0f, WHITE);
+                DrawTextEx(zainBlack, timerText, (Vector2){timerTextX, timerTextY}, timerFontSize, 1.0f, WHITE);
 
-        EndTextureMode();
+            EndTextureMode();
+            needsRedraw = false;
+            renderCount++;
+        }
 
+        // still begin/end while minimized, EndDrawing is what polls for events
         BeginDrawing();
-            ClearBackground(BLACK);           
-            DrawTexturePro(windowTexture.texture, (Rectangle){0, 0, (float)windowTexture.texture.width, -(float)windowTexture.texture.height}, (Rectangle){0, 0, windowSize.x, windowSize.y}, (Vector2){0, 0}, 0.0f, WHITE);
-            DrawTextEx(zainRegular, TextFormat("FPS: %i", GetFPS()), (Vector2){10, 50}, 20 * scale, 1.0f, GREEN);
+            if (!windowMinimized) {
+                ClearBackground(BLACK);
+                DrawTexturePro(windowTexture.texture, (Rectangle){0, 0, (float)windowTexture.texture.width, -(float)windowTexture.texture.height}, (Rectangle){0, 0, windowSize.x, windowSize.y}, (Vector2){0, 0}, 0.0f, WHITE);
+                // fps means nothing with event waiting, show how often the ui was rebuilt vs just shown
+                blitCount++;
+                DrawTextEx(zainRegular, TextFormat("renders: %i  blits: %i", renderCount, blitCount), (Vector2){10, 50}, 20 * scale, 1.0f, GREEN);
+            }
         EndDrawing();
     }
 
     // cleanup resources
+    captureWorker.Stop();
     if (textureLoaded) {
         UnloadTexture(screenTexture);
     }
@@ -488,6 +553,144 @@ float Clamp(float value, float min, float max) {
     return (value < min) ? min : (value > max) ? max : value;
 }
 
+// capture worker implementation
+CaptureWorker::CaptureWorker(int maxFps, double clientRefreshInterval)
+    : frameReady(false), clientDetected(false), minimized(false), timerRunning(false), timerStart(0.0),
+      wakeRequested(false), stopping(false), frameInterval(1.0 / maxFps), clientRefreshInterval(clientRefreshInterval) {}
+
+CaptureWorker::~CaptureWorker() {
+    Stop();
+}
+
+void CaptureWorker::Start() {
+    if (worker.joinable()) return;
+    stopping = false;
+    worker = thread(&CaptureWorker::Run, this);
+}
+
+void CaptureWorker::Stop() {
+    {
+        lock_guard<mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+// hands over the newest frame if one arrived since the last call, empty when the client is gone
+bool CaptureWorker::TakeFrame(cv::Mat& frame) {
+    lock_guard<mutex> lock(stateMutex);
+    if (!frameReady) return false;
+    frame = latestFrame;
+    latestFrame.release();
+    frameReady = false;
+    return true;
+}
+
+void CaptureWorker::SetMinimized(bool value) {
+    {
+        lock_guard<mutex> lock(stateMutex);
+        if (minimized == value) return;
+        minimized = value;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+void CaptureWorker::SetTimer(bool running, double start) {
+    {
+        lock_guard<mutex> lock(stateMutex);
+        timerRunning = running;
+        timerStart = start;
+        wakeRequested = true;
+    }
+    wakeCondition.notify_one();
+}
+
+void CaptureWorker::Run() {
+    const int MAX_FAILED_FRAMES = 3;
+    bool clientAvailable = false;
+    int failedFrames = 0;
+    double nextRefreshTime = 0.0;
+    int lastTimerSecond = -1;
+
+    unique_lock<mutex> lock(stateMutex);
+    while (!stopping) {
+        // nothing reads frames while minimized, sleep until restore or shutdown
+        if (minimized) {
+            wakeCondition.wait(lock, [this] { return stopping || wakeRequested; });
+            wakeRequested = false;
+            continue;
+        }
+
+        double now = GetTime();
+        bool wakeUi = false;
+
+        bool clientAlive = true;
+
+        // look for the client again every refresh interval while it is missing or failing
+        if (!clientAvailable && now >= nextRefreshTime) {
+            lock.unlock();
+            bool found = screenCap.Initialize();
+            clientAlive = screenCap.IsClientAlive();
+            lock.lock();
+            clientAvailable = found;
+            failedFrames = 0;
+            nextRefreshTime = now + clientRefreshInterval;
+        }
+
+        if (clientAvailable) {
+            lock.unlock();
+            cv::Mat frame = screenCap.CaptureScreen();
+            clientAlive = frame.empty() ? screenCap.IsClientAlive() : true;
+            lock.lock();
+            if (!frame.empty()) {
+                latestFrame = frame;
+                frameReady = true;
+                clientDetected = true;
+                failedFrames = 0;
+                wakeUi = true;
+            } else if (!clientAlive || ++failedFrames >= MAX_FAILED_FRAMES) {
+                // a glitch on a live window is retried next frame, if it keeps failing (roblox
+                // minimized, blit refused) back off and reinitialize on the next refresh
+                clientAvailable = false;
+                nextRefreshTime = now + clientRefreshInterval;
+            }
+        }
+
+        // window is gone, swap the stale preview for the not detected message
+        if (!clientAlive && clientDetected) {
+            latestFrame.release();
+            frameReady = true;
+            clientDetected = false;
+            wakeUi = true;
+        }
+
+        double waitTime = clientAvailable ? frameInterval : nextRefreshTime - now;
+
+        // tick the ui once per second so the counter updates
+        if (timerRunning) {
+            int timerSecond = (int)(now - timerStart);
+            if (timerSecond != lastTimerSecond) {
+                lastTimerSecond = timerSecond;
+                wakeUi = true;
+            }
+            waitTime = min(waitTime, timerStart + timerSecond + 1 - now);
+        } else {
+            lastTimerSecond = -1;
+        }
+
+        if (wakeUi) {
+            glfwPostEmptyEvent();
+        }
+
+        wakeCondition.wait_for(lock, chrono::duration<double>(max(waitTime, 0.0)), [this] { return stopping || wakeRequested; });
+        wakeRequested = false;
+    }
+}
+
 // platform-specific implementations
 #ifdef _WIN32
 struct WindowsScreenCapture {
@@ -503,7 +706,25 @@ struct WindowsScreenCapture {
     WindowsScreenCapture() : hwndRoblox(NULL), hdcScreen(NULL), hdcMemDC(NULL),
                              hbmScreen(NULL), captureWidth(0), captureHeight(0) {}
 
+    // drops the memory dc and bitmap, kept separate so a resize can rebuild just these
+    void ReleaseBitmap() {
+        if (hdcMemDC) DeleteDC(hdcMemDC);
+        if (hbmScreen) DeleteObject(hbmScreen);
+        hdcMemDC = NULL;
+        hbmScreen = NULL;
+    }
+
+    void Release() {
+        ReleaseBitmap();
+        if (hdcScreen && hwndRoblox) ReleaseDC(hwndRoblox, hdcScreen);
+        hdcScreen = NULL;
+        hwndRoblox = NULL;
+    }
+
     bool Initialize() {
+        // safe to call again, handles from an earlier attempt are released first
+        Release();
+
         hwndRoblox = FindWindowA(NULL, "Roblox");
         if (!hwndRoblox) {
             return false;
@@ -527,13 +748,12 @@ struct WindowsScreenCapture {
 
         hdcMemDC = CreateCompatibleDC(hdcScreen);
         if (!hdcMemDC) {
-            ReleaseDC(hwndRoblox, hdcScreen);
+            Release();
             return false;
         }
         hbmScreen = CreateCompatibleBitmap(hdcScreen, captureWidth, captureHeight);
         if (!hbmScreen) {
-            DeleteDC(hdcMemDC);
-            ReleaseDC(hwndRoblox, hdcScreen);
+            Release();
             return false;
         }
         SelectObject(hdcMemDC, hbmScreen);
@@ -543,8 +763,12 @@ struct WindowsScreenCapture {
         return true;
     }
 
+    bool IsClientAlive() {
+        return hwndRoblox && IsWindow(hwndRoblox);
+    }
+
     cv::Mat CaptureScreen() {
-        if (!hwndRoblox || !hdcScreen || !hdcMemDC || !hbmScreen) {
+        if (!hwndRoblox || !hdcScreen) {
             return cv::Mat();
         }
 
@@ -559,18 +783,23 @@ struct WindowsScreenCapture {
         int width = clientRect.right - clientRect.left;
         int height = clientRect.bottom - clientRect.top;
 
-        if (width != captureWidth || height != captureHeight) {
+        // client is 0x0 while roblox is minimized, nothing to grab until it comes back
+        if (width <= 0 || height <= 0) {
+            return cv::Mat();
+        }
+
+        // rebuild on resize, or if a previous rebuild failed
+        if (width != captureWidth || height != captureHeight || !hdcMemDC || !hbmScreen) {
             captureWidth = width;
             captureHeight = height;
-            DeleteObject(hbmScreen);
-            DeleteDC(hdcMemDC);
+            ReleaseBitmap();
             hbmScreen = CreateCompatibleBitmap(hdcScreen, captureWidth, captureHeight);
             if (!hbmScreen) {
                 return cv::Mat();
             }
             hdcMemDC = CreateCompatibleDC(hdcScreen);
             if (!hdcMemDC) {
-                DeleteObject(hbmScreen);
+                ReleaseBitmap();
                 return cv::Mat();
             }
             SelectObject(hdcMemDC, hbmScreen);
@@ -604,9 +833,7 @@ struct WindowsScreenCapture {
     }
 
     ~WindowsScreenCapture() {
-        if (hdcMemDC) DeleteDC(hdcMemDC);
-        if (hbmScreen) DeleteObject(hbmScreen);
-        if (hdcScreen && hwndRoblox) ReleaseDC(hwndRoblox, hdcScreen);
+        Release();
     }
 };
 
@@ -622,6 +849,10 @@ bool ScreenCapture::Initialize() {
     return static_cast<WindowsScreenCapture*>(impl)->Initialize();
 }
 
+bool ScreenCapture::IsClientAlive() {
+    return static_cast<WindowsScreenCapture*>(impl)->IsClientAlive();
+}
+
 cv::Mat ScreenCapture::CaptureScreen() {
     return static_cast<WindowsScreenCapture*>(impl)->CaptureScreen();
 }
@@ -633,6 +864,10 @@ bool ScreenCapture::Initialize() {
     return false;
 }
 
+bool ScreenCapture::IsClientAlive() {
+    return false;
+}
+
 cv::Mat ScreenCapture::CaptureScreen() {
     return cv::Mat();
 }